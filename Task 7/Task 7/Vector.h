@@ -2,13 +2,251 @@
 #define VECTOR_H
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
 #include <utility>
 
-template <typename T> class Vector;
-template <typename T> std::ostream& operator<<(std::ostream& os, const Vector<T>& v);
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Выравнивание буфера Vector по умолчанию.
+ *
+ * Для арифметических типов буфер выравнивается по 64 байтам (размер строки кэша),
+ * чтобы SIMD-обработка не делала невыровненных загрузок и не пересекала строки кэша.
+ * Для остальных типов используется естественное выравнивание alignof(T).
+ */
+template <typename T>
+inline constexpr size_t default_vector_alignment = std::is_arithmetic_v<T> ? size_t(64) : alignof(T);
+
+/**
+ * @brief Порог размера буфера (в байтах), начиная с которого используется mmap.
+ *
+ * Буферы такого размера и больше выделяются через mmap с MADV_HUGEPAGE
+ * (прозрачные огромные страницы) и растут через mremap без копирования.
+ * Работает только на Linux и только для тривиально копируемых типов.
+ */
+inline constexpr size_t vector_huge_page_threshold = size_t(2) * 1024 * 1024;
+
+/**
+ * @struct VectorAllocStats
+ * @brief Снимок статистики выделений памяти всеми векторами.
+ */
+struct VectorAllocStats {
+    size_t heap_allocations = 0; ///< Выделения в куче через operator new.
+    size_t mmap_allocations = 0; ///< Выделения через mmap.
+    size_t huge_page_advised = 0; ///< mmap-выделения, для которых ядро приняло MADV_HUGEPAGE (не гарантирует получение огромных страниц).
+    size_t mremap_growths = 0; ///< Увеличения ёмкости через mremap (без копирования элементов).
+    size_t mapped_bytes = 0; ///< Текущий объём памяти, выделенной через mmap.
+};
+
+namespace vector_detail {
+
+    /**
+     * @brief Счётчики выделений, общие для всех экземпляров Vector.
+     */
+    struct AllocCounters {
+        std::atomic<size_t> heap_allocations{ 0 };
+        std::atomic<size_t> mmap_allocations{ 0 };
+        std::atomic<size_t> huge_page_advised{ 0 };
+        std::atomic<size_t> mremap_growths{ 0 };
+        std::atomic<size_t> mapped_bytes{ 0 };
+    };
+
+    inline AllocCounters counters;
+
+    /**
+     * @brief Выделяет в куче буфер, выровненный по alignment байтам.
+     * @param bytes Размер буфера.
+     * @param alignment Выравнивание (степень двойки).
+     * @return Указатель на выровненный буфер.
+     *
+     * Выровненный operator new в glibc заметно медленнее обычного на небольших буферах,
+     * поэтому буфер выделяется с запасом в alignment байт, а исходный указатель
+     * сохраняется непосредственно перед выровненным началом.
+     */
+    inline void* heap_allocate(size_t bytes, size_t alignment) {
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(bytes);
+        if (bytes > size_t(-1) - alignment)
+            throw std::bad_array_new_length();
+
+        void* raw = ::operator new(bytes + alignment);
+        // raw выровнен по __STDCPP_DEFAULT_NEW_ALIGNMENT__, поэтому отступ не меньше sizeof(void*).
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + alignment) & ~(uintptr_t(alignment) - 1);
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /**
+     * @brief Освобождает буфер, выделенный через heap_allocate.
+     */
+    inline void heap_deallocate(void* p, size_t alignment) {
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(p);
+        else
+            ::operator delete(static_cast<void**>(p)[-1]);
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief Размер прозрачной огромной страницы (THP).
+     *
+     * Огромная страница может покрыть только выровненный по этому размеру диапазон,
+     * поэтому области mmap выравниваются и округляются до него.
+     */
+    inline constexpr size_t huge_page_size = size_t(2) * 1024 * 1024;
+
+    /**
+     * @brief Наибольший размер области, которую можно выделить через mmap.
+     *
+     * Гарантирует, что ни округление до огромных страниц, ни запас на выравнивание
+     * в map_aligned не переполнят size_t.
+     */
+    inline constexpr size_t max_mapped_bytes = size_t(-1) - 2 * huge_page_size;
+
+    /**
+     * @brief Округляет размер в байтах вверх до целого числа огромных страниц.
+     *
+     * bytes не должен превышать max_mapped_bytes.
+     */
+    inline size_t round_to_huge_pages(size_t bytes) {
+        return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+
+    /**
+     * @brief Выделяет анонимную область, начало которой выровнено по huge_page_size.
+     * @param bytes Размер области (кратен huge_page_size).
+     * @return Указатель на область или nullptr, если mmap не удался.
+     *
+     * Выделяет область на huge_page_size больше и освобождает невыровненные голову и хвост.
+     */
+    inline void* map_aligned(size_t bytes) {
+        if (bytes == 0 || bytes > max_mapped_bytes) return nullptr;
+
+        size_t reserve = bytes + huge_page_size;
+        void* raw = mmap(nullptr, reserve, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) return nullptr;
+
+        uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (begin + huge_page_size - 1) / huge_page_size * huge_page_size;
+        size_t head = aligned - begin;
+        size_t tail = reserve - head - bytes;
+        if (head) munmap(raw, head);
+        if (tail) munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /**
+     * @brief Выделяет выровненную область через mmap и запрашивает огромные страницы.
+     * @param bytes Размер области (кратен huge_page_size).
+     * @return Указатель на область или nullptr, если mmap не удался.
+     */
+    inline void* map_pages(size_t bytes) {
+        void* p = map_aligned(bytes);
+        if (!p) return nullptr;
+        counters.mmap_allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.mapped_bytes.fetch_add(bytes, std::memory_order_relaxed);
+#if defined(MADV_HUGEPAGE)
+        if (madvise(p, bytes, MADV_HUGEPAGE) == 0)
+            counters.huge_page_advised.fetch_add(1, std::memory_order_relaxed);
+#endif
+        return p;
+    }
+
+    /**
+     * @brief Увеличивает область, выделенную через map_pages, без копирования данных.
+     * @return Новый адрес области или nullptr, если mremap не удался (старая область не тронута).
+     *
+     * Сначала пробует расширить область на месте; иначе переносит страницы
+     * в заранее выделенную выровненную область, сохраняя выравнивание по huge_page_size.
+     */
+    inline void* remap_pages(void* p, size_t old_bytes, size_t new_bytes) {
+        void* q = mremap(p, old_bytes, new_bytes, 0);
+        if (q == MAP_FAILED) {
+            void* target = map_aligned(new_bytes);
+            if (!target) return nullptr;
+            q = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (q == MAP_FAILED) {
+                munmap(target, new_bytes);
+                return nullptr;
+            }
+        }
+        counters.mremap_growths.fetch_add(1, std::memory_order_relaxed);
+        counters.mapped_bytes.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+#if defined(MADV_HUGEPAGE)
+        madvise(q, new_bytes, MADV_HUGEPAGE);
+#endif
+        return q;
+    }
+
+    /**
+     * @brief Освобождает область, выделенную через map_pages.
+     */
+    inline void unmap_pages(void* p, size_t bytes) {
+        munmap(p, bytes);
+        counters.mapped_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Возвращает объём области, фактически покрытый огромными страницами.
+     * @param p Начало области.
+     * @param bytes Размер области.
+     * @return Сумма AnonHugePages из /proc/self/smaps для отображений, целиком лежащих в области.
+     *
+     * Ядро может объединить соседние отображения с одинаковыми флагами в одно.
+     * Такое отображение выходит за границы области и не учитывается, чтобы не приписать
+     * области огромные страницы соседа, поэтому результат — нижняя оценка.
+     */
+    inline size_t anon_huge_page_bytes(const void* p, size_t bytes) {
+        std::ifstream smaps("/proc/self/smaps");
+        uintptr_t begin = reinterpret_cast<uintptr_t>(p);
+        uintptr_t end = begin + bytes;
+        bool inside = false;
+        size_t total = 0;
+        std::string line;
+        while (std::getline(smaps, line)) {
+            unsigned long long lo = 0, hi = 0;
+            if (std::sscanf(line.c_str(), "%llx-%llx", &lo, &hi) == 2) {
+                inside = lo >= begin && hi <= end;
+            }
+            else if (inside && line.rfind("AnonHugePages:", 0) == 0) {
+                total += std::stoull(line.substr(14)) * 1024;
+            }
+        }
+        return total;
+    }
+#endif
+
+} // namespace vector_detail
+
+/**
+ * @brief Возвращает текущую статистику выделений памяти векторами.
+ * @return Снимок счётчиков.
+ */
+inline VectorAllocStats vector_alloc_stats() {
+    using vector_detail::counters;
+    VectorAllocStats stats;
+    stats.heap_allocations = counters.heap_allocations.load(std::memory_order_relaxed);
+    stats.mmap_allocations = counters.mmap_allocations.load(std::memory_order_relaxed);
+    stats.huge_page_advised = counters.huge_page_advised.load(std::memory_order_relaxed);
+    stats.mremap_growths = counters.mremap_growths.load(std::memory_order_relaxed);
+    stats.mapped_bytes = counters.mapped_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+template <typename T, size_t Alignment = default_vector_alignment<T>> class Vector;
+template <typename T, size_t Alignment> std::ostream& operator<<(std::ostream& os, const Vector<T, Alignment>& v);
 
 /**
  * @brief Проверка на поддержку действия у данных типов данных.
@@ -30,36 +268,160 @@ constexpr bool supports_operator() {
  * поддерживающую изменение размера, добавление и удаление элементов, сравнение,
  * а также поэлементные операции над векторами одного типа.
  * Также включает перегруженные операторы для удобства.
+ *
+ * Буфер выравнивается по Alignment байтам. Большие буферы тривиально копируемых
+ * типов (от vector_huge_page_threshold байт) на Linux выделяются через mmap
+ * с огромными страницами и растут через mremap.
  */
-template <typename T>
+template <typename T, size_t Alignment>
 class Vector {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+    static_assert(Alignment >= alignof(T), "Alignment must not be weaker than alignof(T).");
+
 private:
     T* data; ///< Указатель на динамически выделенный массив.
     size_t size; ///< Текущее количество элементов в векторе.
     size_t capacity; ///< Текущая ёмкость выделенного массива.
+    bool mapped = false; ///< True, если массив выделен через mmap.
+
+    /**
+     * @brief Возвращает размер буфера в байтах для заданной ёмкости.
+     *
+     * Бросает std::bad_array_new_length при переполнении, как и new T[].
+     */
+    static size_t bytes_for(size_t count) {
+        if (count > size_t(-1) / sizeof(T))
+            throw std::bad_array_new_length();
+        return count * sizeof(T);
+    }
+
+    /**
+     * @brief Проверяет, можно ли выделить буфер такого размера через mmap.
+     *
+     * mremap переносит байты, поэтому путь доступен только для тривиально копируемых типов.
+     * Слишком большие буферы идут в кучу, где operator new сообщит о нехватке памяти.
+     * Хвост буфера после mremap конструируется на месте, поэтому конструктор не должен бросать.
+     */
+    static bool use_mapping(size_t bytes) {
+#if defined(__linux__)
+        return std::is_trivially_copyable_v<T>
+            && std::is_nothrow_default_constructible_v<T>
+            && bytes >= vector_huge_page_threshold
+            && bytes <= vector_detail::max_mapped_bytes
+            && Alignment <= vector_detail::huge_page_size;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Выделяет выровненный буфер под count элементов без их конструирования.
+     * @param count Количество элементов.
+     * @param is_mapped Устанавливается в true, если буфер выделен через mmap.
+     * @return Указатель на начало буфера.
+     */
+    static T* allocate(size_t count, bool& is_mapped) {
+        size_t bytes = bytes_for(count);
+        void* raw = nullptr;
+        is_mapped = false;
+#if defined(__linux__)
+        if (use_mapping(bytes)) {
+            raw = vector_detail::map_pages(vector_detail::round_to_huge_pages(bytes));
+            is_mapped = raw != nullptr;
+        }
+#endif
+        if (!raw) {
+            raw = vector_detail::heap_allocate(bytes, Alignment);
+            vector_detail::counters.heap_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return static_cast<T*>(raw);
+    }
+
+    /**
+     * @brief Создаёт буфер ёмкостью count и конструирует в нём элементы.
+     * @param count Ёмкость буфера.
+     * @param src Источник для копирования первых used элементов; nullptr — сконструировать их значением по умолчанию T().
+     * @param used Количество элементов, которые копируются из src или инициализируются T().
+     * @param is_mapped Устанавливается в true, если буфер выделен через mmap.
+     * @return Указатель на первый элемент.
+     *
+     * Остальные элементы до count конструируются по умолчанию без обнуления,
+     * поэтому каждый байт буфера записывается не более одного раза.
+     */
+    static T* create(size_t count, const T* src, size_t used, bool& is_mapped) {
+        T* p = allocate(count, is_mapped);
+        size_t constructed = 0;
+        try {
+            if (src)
+                std::uninitialized_copy_n(src, used, p);
+            // Анонимные страницы mmap уже заполнены нулями, что совпадает с T() для арифметических типов.
+            else if (!(is_mapped && std::is_arithmetic_v<T>))
+                std::uninitialized_value_construct_n(p, used);
+            constructed = used;
+            std::uninitialized_default_construct_n(p + used, count - used);
+        }
+        catch (...) {
+            std::destroy_n(p, constructed);
+            deallocate(p, count, is_mapped);
+            throw;
+        }
+        return p;
+    }
+
+    /**
+     * @brief Освобождает буфер без разрушения элементов.
+     */
+    static void deallocate(T* p, size_t count, bool is_mapped) {
+#if defined(__linux__)
+        if (is_mapped) {
+            vector_detail::unmap_pages(p, vector_detail::round_to_huge_pages(count * sizeof(T)));
+            return;
+        }
+#endif
+        (void)count;
+        (void)is_mapped;
+        vector_detail::heap_deallocate(p, Alignment);
+    }
+
+    /**
+     * @brief Разрушает count элементов и освобождает буфер.
+     */
+    static void release(T* p, size_t count, bool is_mapped) {
+        if (!p) return;
+        std::destroy_n(p, count);
+        deallocate(p, count, is_mapped);
+    }
 
     /**
      * @brief Изменяет размер внутреннего массива на новую ёмкость.
      * @param new_capacity Новая ёмкость для массива.
      *
-     * Выделяет новый массив, копирует существующие элементы и освобождает старый массив.
+     * Буфер, выделенный через mmap, расширяется через mremap без копирования элементов.
+     * Иначе выделяет новый массив, копирует существующие элементы и освобождает старый массив.
      * Эта функция обрабатывает перераспределение памяти.
      */
     void resize(size_t new_capacity) {
-        T* new_data = new T[new_capacity];
-        try {
-            if (data) {
-                for (size_t i = 0; i < size; ++i)
-                    new_data[i] = data[i];
+#if defined(__linux__)
+        size_t requested = bytes_for(new_capacity);
+        if (mapped && requested <= vector_detail::max_mapped_bytes) {
+            size_t old_bytes = vector_detail::round_to_huge_pages(capacity * sizeof(T));
+            size_t new_bytes = vector_detail::round_to_huge_pages(requested);
+            void* moved = old_bytes == new_bytes ? data : vector_detail::remap_pages(data, old_bytes, new_bytes);
+            if (moved) {
+                data = static_cast<T*>(moved);
+                std::uninitialized_default_construct_n(data + capacity, new_capacity - capacity);
+                capacity = new_capacity;
+                return;
             }
         }
-        catch (...) {
-            delete[] new_data;
-            throw;
-        }
-        delete[] data;
+#endif
+        bool new_mapped = false;
+        T* new_data = create(new_capacity, data, size, new_mapped);
+        release(data, capacity, mapped);
         data = new_data;
         capacity = new_capacity;
+        mapped = new_mapped;
     }
 
 
@@ -72,7 +434,7 @@ public:
      * Инициализирует пустой вектор с начальной ёмкостью 10.
      */
     Vector() : size(0), capacity(10) {
-        data = new T[capacity]();
+        data = create(capacity, nullptr, 0, mapped);
     }
 
     /**
@@ -82,7 +444,7 @@ public:
      * Инициализирует вектор заданного размера, элементы конструируются по умолчанию.
      */
     Vector(size_t initial_size) : size(initial_size), capacity(std::max(initial_size, size_t(1)) * 2) {
-        data = new T[capacity]();
+        data = create(capacity, nullptr, size, mapped);
     }
 
     /**
@@ -92,14 +454,7 @@ public:
      * Создаёт глубокую копию предоставленного вектора.
      */
     Vector(const Vector& other) : size(other.size), capacity(other.capacity) {
-        data = new T[capacity]();
-        try {
-            std::copy(other.data, other.data + size, data);
-        }
-        catch (...) {
-            delete[] data;
-            throw;
-        }
+        data = create(capacity, other.data, size, mapped);
     }
 
     /**
@@ -111,18 +466,13 @@ public:
      */
     Vector& operator=(const Vector& other) {
         if (this != &other) {
-            T* new_data = new T[other.capacity]();
-            try {
-                std::copy(other.data, other.data + other.size, new_data);
-            }
-            catch (...) {
-                delete[] new_data;
-                throw;
-            }
-            delete[] data;
+            bool new_mapped = false;
+            T* new_data = create(other.capacity, other.data, other.size, new_mapped);
+            release(data, capacity, mapped);
             data = new_data;
             size = other.size;
             capacity = other.capacity;
+            mapped = new_mapped;
         }
         return *this;
     }
@@ -133,7 +483,7 @@ public:
      * Освобождает динамический массив.
      */
     ~Vector() {
-        delete[] data;
+        release(data, capacity, mapped);
     }
 
     /**
@@ -194,6 +544,30 @@ public:
         return size;
     }
 
+    /**
+     * @brief Проверяет, выделен ли буфер через mmap с запросом огромных страниц.
+     * @return True, если буфер выделен через mmap.
+     */
+    bool is_mapped() const {
+        return mapped;
+    }
+
+    /**
+     * @brief Возвращает объём буфера, фактически покрытый огромными страницами.
+     * @return Количество байт по данным /proc/self/smaps; 0, если буфер не выделен через mmap.
+     *
+     * Ядро выделяет огромные страницы при первом обращении к памяти,
+     * поэтому для ещё не заполненного буфера значение может быть нулевым.
+     * Если ядро объединило отображение буфера с соседним, возвращается 0.
+     */
+    size_t huge_page_bytes() const {
+#if defined(__linux__)
+        if (mapped)
+            return vector_detail::anon_huge_page_bytes(data, vector_detail::round_to_huge_pages(capacity * sizeof(T)));
+#endif
+        return 0;
+    }
+
     /**
      * @brief Доступ к элементу по индексу (константная версия).
      * @param index Индекс для доступа.
@@ -221,9 +595,9 @@ public:
      * @param other Вектор для сравнения.
      * @return True, если размеры и элементы совпадают, иначе false.
      */
-    template <typename U>
+    template <typename U, size_t UAlignment>
         requires requires (T a, U b) { a == b; }
-    bool operator==(const Vector<U>& other) const {
+    bool operator==(const Vector<U, UAlignment>& other) const {
         if (size != other.get_size()) {
             std::cerr << "Vectors must be same size for multiplication.\n";
             return false;
@@ -242,9 +616,9 @@ public:
      * Требует одинаковых размеров; возвращает пустой вектор, если размеры отличаются.
      * Предполагает, что T поддерживает operator+.
      */
-    template <typename U>
+    template <typename U, size_t UAlignment>
         requires requires (T a, U b) { a + b; }
-    auto operator+(const Vector<U>& other) const {
+    auto operator+(const Vector<U, UAlignment>& other) const {
         using R = decltype(std::declval<T>() + std::declval<U>());
 
         if (size != other.get_size()) {
@@ -266,9 +640,9 @@ public:
      * Требует одинаковых размеров; возвращает пустой вектор, если размеры отличаются.
      * Предполагает, что T поддерживает operator*.
      */
-    template <typename U>
+    template <typename U, size_t UAlignment>
         requires requires (T a, U b) { a* b; }
-    auto operator*(const Vector<U>& other) const {
+    auto operator*(const Vector<U, UAlignment>& other) const {
         using R = decltype(std::declval<T>()* std::declval<U>());
 
         if (size != other.get_size()) {
@@ -283,7 +657,7 @@ public:
     }
 
     // Объявление дружественной функции для оператора вывода
-    friend std::ostream& operator<< <T> (std::ostream& os, const Vector<T>& v);
+    friend std::ostream& operator<< <T, Alignment> (std::ostream& os, const Vector<T, Alignment>& v);
 };
 
 /**
@@ -295,8 +669,8 @@ public:
  * Печатает вектор в формате: [1, 2, 3]
  * Предполагает, что T поддерживает operator<<.
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const Vector<T>& v) {
+template <typename T, size_t Alignment>
+std::ostream& operator<<(std::ostream& os, const Vector<T, Alignment>& v) {
     os << "[";
     for (size_t i = 0; i < v.size; ++i) {
         os << v.data[i];
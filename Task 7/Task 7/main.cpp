@@ -35,6 +35,7 @@ void printMenu() {
     std::cout << "10. Show all vectors" << std::endl;
     std::cout << "11. Change current vector" << std::endl;
     std::cout << "12. Delete vector" << std::endl;
+    std::cout << "13. Show allocation statistics" << std::endl;
     std::cout << "0. Exit" << std::endl;
     std::cout << "Choose an option: ";
 }
@@ -347,6 +348,27 @@ int main() {
             break;
         }
 
+        case 13: {
+            VectorAllocStats stats = vector_alloc_stats();
+            std::cout << "Heap allocations: " << stats.heap_allocations << std::endl;
+            std::cout << "mmap allocations: " << stats.mmap_allocations << std::endl;
+            std::cout << "Huge page advised mappings: " << stats.huge_page_advised << std::endl;
+            std::cout << "mremap growths: " << stats.mremap_growths << std::endl;
+            std::cout << "Mapped bytes: " << stats.mapped_bytes << std::endl;
+
+            for (size_t i = 0; i < vectors.size(); ++i) {
+                std::visit([i](auto&& vec) {
+                    std::cout << "Vector #" << i << ": "
+                        << (vec.is_mapped() ? "mmap" : "heap")
+                        << ", huge page bytes: " << vec.huge_page_bytes() << std::endl;
+                    }, vectors[i]);
+            }
+            if (!vectors.empty())
+                std::cout << "(huge page bytes is a lower bound: a mapping merged by the kernel "
+                    "with a neighbouring one is reported as 0)" << std::endl;
+            break;
+        }
+
         case 0:
             std::cout << "Goodbye!\n";
             break;